@@ -52,10 +52,7 @@ int main(int argc, char *argv[])
 {
     uint32_t nClients = 50; // default
     uint32_t runNum = 1;    // default RNG run number
-
-    ns3::CommandLine cmd(__FILE__);
-    cmd.AddValue("nClients", "Number of client nodes (passengers)", nClients);
-    cmd.Parse(argc, argv);
+    uint32_t seed = 1;      // default RNG seed
 
     double simulation_time = 2400.0; // seconds
     double onTime_min = 1.0;
@@ -67,8 +64,23 @@ int main(int argc, char *argv[])
     std::string server_data_rate = "1Mbps"; // server to bottleneck link data rate
     std::string packet_size = "512";        // bytes
 
+    ns3::CommandLine cmd(__FILE__);
+    cmd.AddValue("nClients", "Number of client nodes (passengers)", nClients);
+    cmd.AddValue("run", "RNG run number", runNum);
+    cmd.AddValue("seed", "RNG seed", seed);
+    cmd.AddValue("simTime", "Simulation time in seconds", simulation_time);
+    cmd.AddValue("onTimeMin", "Lower bound of the OnOff on time (s)", onTime_min);
+    cmd.AddValue("onTimeMax", "Upper bound of the OnOff on time (s)", onTime_max);
+    cmd.AddValue("offTimeMin", "Lower bound of the OnOff off time (s)", offTime_min);
+    cmd.AddValue("offTimeMax", "Upper bound of the OnOff off time (s)", offTime_max);
+    cmd.AddValue("dataRate", "Data rate of the point-to-point links", data_rate);
+    cmd.AddValue("delay", "Delay of the point-to-point links", delay);
+    cmd.AddValue("serverDataRate", "OnOff data rate per client", server_data_rate);
+    cmd.AddValue("packetSize", "OnOff packet size in bytes", packet_size);
+    cmd.Parse(argc, argv);
+
     // set different RNG run number for each simulation run to get different traffic patterns
-    ns3::RngSeedManager::SetSeed(1);
+    ns3::RngSeedManager::SetSeed(seed);
     ns3::RngSeedManager::SetRun(runNum);
 
     ns3::Ptr<ns3::Node> server = ns3::CreateObject<ns3::Node>();
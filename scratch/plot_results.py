@@ -1,44 +1,114 @@
+import hashlib
+import json
+import os
 import subprocess
 import numpy as np
 import matplotlib.pyplot as plt
 
+SIMULATION_SOURCE = "scratch/fleight_entertainment_system_simulation.cc"
+CACHE_DIR = "results_cache"
+
 # client_counts = [50,60,70,80,90,100,110,120]
 client_counts = [5,10,15,20]
 runs_per_scenario = 10 # minutes
 
+# scenario parameters shared by every (nClients, run) point, passed to the simulation as --key=value
+scenario = {
+    "seed": 1,
+    "simTime": 2400.0,  # seconds
+    "onTimeMin": 1.0,
+    "onTimeMax": 3.0,
+    "offTimeMin": 1.0,
+    "offTimeMax": 40.0,
+    "dataRate": "10Mbps",
+    "delay": "3ms",
+    "serverDataRate": "1Mbps",
+    "packetSize": "512",  # bytes
+}
+
+
+def simulator_version():
+    """Fingerprint of the simulation source and the ns-3 release, so edits to either invalidate the cache."""
+    h = hashlib.sha256()
+    for path in (SIMULATION_SOURCE, "VERSION"):
+        if os.path.exists(path):
+            with open(path, "rb") as f:
+                h.update(f.read())
+    return h.hexdigest()
+
+
+def cache_key(config):
+    blob = json.dumps(config, sort_keys=True).encode()
+    return hashlib.sha256(blob).hexdigest()
+
+
+def load_cached(key):
+    path = os.path.join(CACHE_DIR, f"{key}.json")
+    if not os.path.exists(path):
+        return None
+    try:
+        with open(path) as f:
+            return json.load(f)["loss"]
+    except (OSError, ValueError, KeyError):
+        # treat unreadable entries as missing, they get overwritten by the rerun
+        return None
+
+
+def store_cached(key, config, loss):
+    os.makedirs(CACHE_DIR, exist_ok=True)
+    path = os.path.join(CACHE_DIR, f"{key}.json")
+    tmp = path + ".tmp"
+    with open(tmp, "w") as f:
+        json.dump({"config": config, "loss": loss}, f, indent=2, sort_keys=True)
+    os.replace(tmp, path)
+
+
+def run_simulation(config):
+    args = " ".join(f"--{k}={v}" for k, v in config.items() if k != "version")
+    cmd = ["./ns3", "run", f"{SIMULATION_SOURCE} {args}"]
+
+    process = subprocess.run(cmd, capture_output=True, text=True)
+    output = process.stdout.strip().split('\n')
+
+    for line in output:
+        if line.startswith("CSV_RESULT"):
+            parts = line.split(',')
+            if len(parts) == 4:
+                return float(parts[3])
+    return None
+
+
 results = {}
+version = simulator_version()
 
 print("-- Starting Simulation --")
 print(f"Scenarios: {client_counts},\nRuns per scenario: {runs_per_scenario}")
+print(f"Result cache: {CACHE_DIR}/ (simulator version {version[:12]})")
 
 for clients in client_counts:
     print(f"\n-- Simulating scenario with {clients} clients --", end="")
     losses = []
 
     for run in range(1, runs_per_scenario + 1):
-        cmd = [
-            "./ns3", "run",
-            f'scratch/fleight_entertainment_system_simulation.cc --nClients={clients}'
-        ]  
-
-        process = subprocess.run(cmd, capture_output=True, text=True)
-        output = process.stdout.strip().split('\n')
-        
-        found = False
-        
-        for line in output:
-                if line.startswith("CSV_RESULT"):
-                    parts = line.split(',')
-                    if len(parts) == 4:
-                        loss = float(parts[3])
-                        losses.append(loss)
-                        print(".", end="", flush=True)
-                        found = True
-                        break
-        
-        if not found:
+        config = dict(scenario, nClients=clients, run=run, version=version)
+        key = cache_key(config)
+
+        # reuse finished replications, only simulate missing or invalidated points
+        loss = load_cached(key)
+        if loss is not None:
+            losses.append(loss)
+            print("c", end="", flush=True)
+            continue
+
+        loss = run_simulation(config)
+        if loss is None:
             print(f"\n[Warning] No valid result found for clients={clients}, run={run}")
-        
+            continue
+
+        store_cached(key, config, loss)
+        losses.append(loss)
+        print(".", end="", flush=True)
+
     if losses:
         results[clients] = np.mean(losses)
     else: